@@ -25,6 +25,7 @@ SamplerAudioProcessorEditor::SamplerAudioProcessorEditor (SamplerAudioProcessor&
         addFloatParameter (paramID);
 
     addReverbEnabledParameter();
+    addMultiOutputParameter();
     addFileSelectorParameter();
 
     addParameterListeners();
@@ -64,6 +65,8 @@ void SamplerAudioProcessorEditor::resized()
 
     auto fileSelectorSlice = bounds.removeFromTop (35);
     fileSelector.setBounds (fileSelectorSlice.removeFromLeft (250));
+    fileSelectorSlice.removeFromLeft (10);
+    multiOutputToggle.setBounds (fileSelectorSlice);
 
     midiKeyboard.setBounds (bounds.removeFromBottom (75));
     bounds.removeFromBottom (10);
@@ -172,6 +175,14 @@ void SamplerAudioProcessorEditor::addReverbEnabledParameter()
     reverbEnabledToggleAttachment.reset (new ButtonAttachment (processor.getAPVTS(), Parameters::reverbEnabled.toString(), reverbEnabledToggle));
 }
 
+void SamplerAudioProcessorEditor::addMultiOutputParameter()
+{
+    multiOutputToggle.setButtonText ("Multi-Output (MIDI Ch 1-4)");
+    addAndMakeVisible (multiOutputToggle);
+
+    multiOutputToggleAttachment.reset (new ButtonAttachment (processor.getAPVTS(), Parameters::multiOutput.toString(), multiOutputToggle));
+}
+
 void SamplerAudioProcessorEditor::addFileSelectorParameter()
 {
     fileSelector.addItemList (Parameters::getSampleFilenames(), 1);
@@ -36,6 +36,7 @@ private:
 
     void addFloatParameter (const Identifier&);
     void addReverbEnabledParameter();
+    void addMultiOutputParameter();
     void addFileSelectorParameter();
 
     //==============================================================================
@@ -86,6 +87,9 @@ private:
     ToggleButton reverbEnabledToggle;
     std::unique_ptr<ButtonAttachment> reverbEnabledToggleAttachment;
 
+    ToggleButton multiOutputToggle;
+    std::unique_ptr<ButtonAttachment> multiOutputToggleAttachment;
+
     using ComboBoxAttachment = AudioProcessorValueTreeState::ComboBoxAttachment;
 
     ComboBox fileSelector;
@@ -11,6 +11,17 @@
 
 static constexpr int maxNumVoices = 16;
 
+//==============================================================================
+AudioProcessor::BusesProperties SamplerAudioProcessor::createBusesProperties()
+{
+    auto buses = BusesProperties().withOutput ("Output", AudioChannelSet::stereo(), true);
+
+    for (int i = 1; i < OutputBuses::numVoiceGroups; ++i)
+        buses = buses.withOutput ("Ch " + String (i + 1), AudioChannelSet::stereo(), false);
+
+    return buses.withOutput ("Reverb", AudioChannelSet::stereo(), false);
+}
+
 //==============================================================================
 AudioProcessorValueTreeState::ParameterLayout SamplerAudioProcessor::createParameterLayout()
 {
@@ -45,12 +56,18 @@ AudioProcessorValueTreeState::ParameterLayout SamplerAudioProcessor::createParam
     }
 
     {
-        auto& info = Parameters::parameterInfoMap[Parameters::reverbEnabled];
-        auto param = std::make_unique<AudioParameterBool> (Parameters::reverbEnabled.toString(), info.labelName,
-                                                           static_cast<bool> (roundToInt (info.defaultValue)));
+        using BoolParamPair = std::pair<Identifier, AudioParameterBool*&>;
 
-        reverbEnabled = param.get();
-        params.push_back (std::move (param));
+        for (auto p : { BoolParamPair (Parameters::reverbEnabled, reverbEnabled),
+                        BoolParamPair (Parameters::multiOutput,   multiOutput) })
+        {
+            auto& info = Parameters::parameterInfoMap[p.first];
+            auto param = std::make_unique<AudioParameterBool> (p.first.toString(), info.labelName,
+                                                               static_cast<bool> (roundToInt (info.defaultValue)));
+
+            p.second = param.get();
+            params.push_back (std::move (param));
+        }
     }
 
     return { params.begin(), params.end() };
@@ -58,11 +75,16 @@ AudioProcessorValueTreeState::ParameterLayout SamplerAudioProcessor::createParam
 
 //==============================================================================
 SamplerAudioProcessor::SamplerAudioProcessor()
-     : AudioProcessor (BusesProperties().withOutput ("Output", AudioChannelSet::stereo(), true)),
+     : AudioProcessor (createBusesProperties()),
        state (*this, nullptr, "PARAMETERS", createParameterLayout())
 {
     for (int i = 0; i < maxNumVoices; ++i)
-        synth.addVoice (new SamplerVoice());
+        synth.addVoice (new RoutedSamplerVoice());
+
+    jassert (getBusCount (false) == OutputBuses::numBuses);
+
+    // The voices are the dry signal, the reverb only contributes its wet output
+    reverbParameters.dryLevel = 0.0f;
 
     formatManager.registerBasicFormats();
 }
@@ -86,8 +108,10 @@ void SamplerAudioProcessor::changeProgramName (int /*index*/, const String&)
 }
 
 //==============================================================================
-void SamplerAudioProcessor::prepareToPlay (double sampleRate, int /*samplesPerBlock*/)
+void SamplerAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    reverbInputBuffer.setSize (2, samplesPerBlock);
+
     midiKeyboardState.reset();
     synth.setCurrentPlaybackSampleRate (sampleRate);
     reverb.setSampleRate (sampleRate);
@@ -108,9 +132,34 @@ bool SamplerAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts)
      && layouts.getMainOutputChannelSet() != AudioChannelSet::stereo())
         return false;
 
+    for (auto& channelSet : layouts.outputBuses)
+        if (! channelSet.isDisabled()
+             && channelSet != AudioChannelSet::mono()
+             && channelSet != AudioChannelSet::stereo())
+            return false;
+
     return true;
 }
 
+//==============================================================================
+static void addBusToBuffer (AudioBuffer<float>& dest, const AudioBuffer<float>& source)
+{
+    const auto numDestChannels   = dest.getNumChannels();
+    const auto numSourceChannels = source.getNumChannels();
+    const auto gain = numSourceChannels > numDestChannels ? 1.0f / numSourceChannels : 1.0f;
+
+    for (int i = 0; i < jmax (numDestChannels, numSourceChannels); ++i)
+        dest.addFrom (i % numDestChannels, 0, source, i % numSourceChannels, 0, dest.getNumSamples(), gain);
+}
+
+void SamplerAudioProcessor::processReverb (AudioBuffer<float>& bufferToProcess)
+{
+    if (bufferToProcess.getNumChannels() == 1)
+        reverb.processMono (bufferToProcess.getWritePointer (0), bufferToProcess.getNumSamples());
+    else
+        reverb.processStereo (bufferToProcess.getWritePointer (0), bufferToProcess.getWritePointer (1), bufferToProcess.getNumSamples());
+}
+
 void SamplerAudioProcessor::processBlock (AudioBuffer<float>& buffer, MidiBuffer& midiMessages)
 {
     if (sampleNeedsUpdating.test_and_set())
@@ -143,19 +192,44 @@ void SamplerAudioProcessor::processBlock (AudioBuffer<float>& buffer, MidiBuffer
     }
 
     const auto numSamples = buffer.getNumSamples();
+    const bool routeToVoiceGroups = *multiOutput;
+
+    buffer.clear();
+    synth.setOutputBuses (*this, buffer, routeToVoiceGroups);
 
     midiKeyboardState.processNextMidiBuffer (midiMessages, 0, numSamples, true);
     synth.renderNextBlock (buffer, midiMessages, 0, numSamples);
+    synth.clearOutputBuses();
 
     if (*reverbEnabled)
     {
         if (! needToResetReverb)
             needToResetReverb = true;
 
-        if (buffer.getNumChannels() == 1)
-            reverb.processMono (buffer.getWritePointer (0), numSamples);
-        else
-            reverb.processStereo (buffer.getWritePointer (0), buffer.getWritePointer (1), numSamples);
+        auto mainBus   = getBusBuffer (buffer, false, OutputBuses::main);
+        auto reverbBus = getBusBuffer (buffer, false, OutputBuses::reverb);
+        const auto reverbIsSend = routeToVoiceGroups && reverbBus.getNumChannels() > 0;
+
+        if (! reverbIsSend)
+        {
+            reverbInputBuffer.setSize (mainBus.getNumChannels(), numSamples, false, false, true);
+            reverbInputBuffer.clear();
+        }
+
+        auto& reverbInput = reverbIsSend ? reverbBus : reverbInputBuffer;
+
+        for (int i = 0; i < OutputBuses::numVoiceGroups; ++i)
+        {
+            auto voiceGroupBus = getBusBuffer (buffer, false, i);
+
+            if (voiceGroupBus.getNumChannels() > 0)
+                addBusToBuffer (reverbInput, voiceGroupBus);
+        }
+
+        processReverb (reverbInput);
+
+        if (! reverbIsSend)
+            addBusToBuffer (mainBus, reverbInput);
     }
     else if (needToResetReverb)
     {
@@ -15,6 +15,7 @@
 namespace Parameters
 {
     static const Identifier currentSample  { "currentSample" };
+    static const Identifier multiOutput    { "multiOutput" };
 
     static const Identifier reverbEnabled  { "reverbEnabled" };
     static const Identifier roomSize       { "roomSize" };
@@ -35,6 +36,7 @@ namespace Parameters
     static std::map<Identifier, ParameterInfo> parameterInfoMap
     {
         { currentSample, { "Current Sample", 3.0f } },
+        { multiOutput,   { "Multi-Output",   0.0f } },
 
         { reverbEnabled, { "Reverb Enabled", 1.0f } },
         { roomSize,      { "Room Size",      0.75f } },
@@ -71,11 +73,100 @@ namespace Parameters
     }
 }
 
+//==============================================================================
+namespace OutputBuses
+{
+    // With the multi-output parameter on, voices on MIDI channel n are routed to voice
+    // group n (bus "Ch n"; the main output is channel 1), falling back to the main output
+    // if that group's bus is disabled. With it off, every voice plays on the main output.
+    // Routing is opt-in because some formats (e.g. AU) enable every bus the plugin declares.
+    // Voices are always rendered dry at unity gain and the reverb only adds its wet signal,
+    // fed by every voice group: onto the reverb bus when multi-output is on and that bus is
+    // enabled, otherwise onto the main output.
+    static constexpr int main           = 0;
+    static constexpr int numVoiceGroups = 4;
+    static constexpr int reverb         = numVoiceGroups;
+    static constexpr int numBuses       = numVoiceGroups + 1;
+}
+
+//==============================================================================
+class RoutedSamplerVoice  : public SamplerVoice
+{
+public:
+    void startNote (int midiNoteNumber, float velocity, SynthesiserSound* s, int currentPitchWheelPosition) override
+    {
+        outputBus = OutputBuses::main;
+
+        for (int channel = 1; channel <= OutputBuses::numVoiceGroups; ++channel)
+        {
+            if (isPlayingChannel (channel))
+            {
+                outputBus = channel - 1;
+                break;
+            }
+        }
+
+        SamplerVoice::startNote (midiNoteNumber, velocity, s, currentPitchWheelPosition);
+    }
+
+    int getOutputBus() const noexcept               { return outputBus; }
+
+private:
+    int outputBus = OutputBuses::main;
+};
+
+//==============================================================================
+class MultiOutputSynthesiser  : public Synthesiser
+{
+public:
+    SynthesiserVoice* addVoice (RoutedSamplerVoice* newVoice)     { return Synthesiser::addVoice (newVoice); }
+
+    // Points each voice group at the host's channels for its bus, so voices render
+    // straight into the output buffer. Must be called before renderNextBlock(), and
+    // followed by clearOutputBuses() so no stale host pointers are kept afterwards.
+    void setOutputBuses (const AudioProcessor& processor, AudioBuffer<float>& hostBuffer, bool routeToVoiceGroups)
+    {
+        for (int i = 0; i < OutputBuses::numVoiceGroups; ++i)
+        {
+            busBuffers[i] = processor.getBusBuffer (hostBuffer, false, routeToVoiceGroups ? i : OutputBuses::main);
+
+            if (busBuffers[i].getNumChannels() == 0)
+                busBuffers[i] = processor.getBusBuffer (hostBuffer, false, OutputBuses::main);
+        }
+    }
+
+    void clearOutputBuses()
+    {
+        for (auto& busBuffer : busBuffers)
+            busBuffer = AudioBuffer<float>();
+    }
+
+protected:
+    using Synthesiser::renderVoices;
+
+    void renderVoices (AudioBuffer<float>& outputAudio, int startSample, int numSamples) override
+    {
+        // setOutputBuses() must have been called with this same buffer
+        jassert (busBuffers[OutputBuses::main].getNumChannels() > 0
+                  && busBuffers[OutputBuses::main].getReadPointer (0) == outputAudio.getReadPointer (0));
+
+        for (auto* voice : voices)
+        {
+            jassert (dynamic_cast<RoutedSamplerVoice*> (voice) != nullptr);
+            voice->renderNextBlock (busBuffers[static_cast<RoutedSamplerVoice*> (voice)->getOutputBus()], startSample, numSamples);
+        }
+    }
+
+private:
+    AudioBuffer<float> busBuffers[OutputBuses::numVoiceGroups];
+};
+
 //==============================================================================
 class SamplerAudioProcessor  : public AudioProcessor,
                                private AsyncUpdater
 {
 private:
+    static BusesProperties createBusesProperties();
     AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
 public:
@@ -127,16 +218,18 @@ public:
 
 private:
     void handleAsyncUpdate() override;
+    void processReverb (AudioBuffer<float>&);
 
     //==============================================================================
     AudioFormatManager formatManager;
     MidiKeyboardState midiKeyboardState;
 
-    Synthesiser synth;
+    MultiOutputSynthesiser synth;
     SynthesiserSound::Ptr sound;
 
     Reverb reverb;
     Reverb::Parameters reverbParameters;
+    AudioBuffer<float> reverbInputBuffer;
     bool needToResetReverb             = false;
     AudioParameterBool*  reverbEnabled = nullptr;
     AudioParameterFloat* roomSize      = nullptr;
@@ -149,6 +242,7 @@ private:
     std::atomic_flag sampleNeedsUpdating  { true };
     std::atomic_flag sampleIsLoaded       { false };
     AudioParameterChoice* currentSample = nullptr;
+    AudioParameterBool* multiOutput     = nullptr;
 
     AudioProcessorValueTreeState state;
 